@@ -42,6 +42,25 @@ typedef struct _AriadneLCS
     AriadneVector3D zAxis;
 } AriadneLCS;
 
+// Ariadne.Kernel orthotropic material (MAT8)
+typedef struct _AriadneOrthotropicMaterial
+{
+    double E1;
+    double E2;
+    double NU12;
+    double G12;
+} AriadneOrthotropicMaterial;
+
+// Ariadne.Kernel plane stress element (CTRIA3, CQUAD4)
+typedef struct _AriadnePlaneStressElement
+{
+    int32_t nodes[4];
+    int32_t nodesCount;
+    int32_t materialIndex;
+    double thickness;
+    double fiberAngle;
+} AriadnePlaneStressElement;
+
 typedef CGAL::Exact_predicates_inexact_constructions_kernel     Kernel;
 typedef Kernel::Point_3                                         Point3D;
 typedef Kernel::Line_3                                          Line3D;
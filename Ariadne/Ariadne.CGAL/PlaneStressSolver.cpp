@@ -0,0 +1,997 @@
+// Copyright 2022 Nikolay V. Zhivotenko
+// Licensed under the Apache License, Version 2.0
+// E-mail: niko.zvt@gmail.com
+
+// PlaneStressSolver.cpp : Defines the exported functions for the DLL application.
+#include "pch.h"
+#include "PlaneStressSolver.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    const int32_t dofsPerNode = 2;
+    const int32_t maxElementNodes = 4;
+    const int32_t maxElementDOFs = dofsPerNode * maxElementNodes;
+
+    // Minimal size of the vector, which is processed by OpenMP threads
+    const int32_t minParallelSize = 4096;
+
+    // Relative tolerances of the element area and of the out-of-plane node offset
+    const double degenerateTolerance = 1.0e-10;
+    const double planeTolerance = 1.0e-6;
+
+    // Relative tolerance of the rank of constraints against the rigid body modes
+    const double rigidBodyTolerance = 1.0e-12;
+
+    // Relative diagonal shift of the incomplete Cholesky factorization
+    const double minFactorShift = 1.0e-3;
+    const double maxFactorShift = 1.0e3;
+
+    // Growth of the relative residual, which is treated as divergence (e.g. singular model without constraints)
+    const double divergenceFactor = 1.0e6;
+
+    const double pi = 3.14159265358979323846;
+
+    typedef std::array<double, maxElementDOFs * maxElementDOFs> ElementMatrix;
+
+    // Plane stress constitutive matrix (xx, yy, xy)
+    typedef std::array<double, 9> ConstitutiveMatrix;
+
+    // Sparse matrix in the CSR format
+    struct SparseMatrix
+    {
+        std::vector<int32_t> rowOffsets;
+        std::vector<int32_t> columns;
+        std::vector<double> values;
+    };
+
+    /// <summary>
+    /// Calculates the product y = A * x.
+    /// </summary>
+    /// <returns>Dot product x * y</returns>
+    double Multiply(const SparseMatrix& A, const std::vector<double>& x, std::vector<double>& y)
+    {
+        int32_t size = static_cast<int32_t>(x.size());
+        double dot = 0.0;
+
+#pragma omp parallel for reduction(+:dot) if(size >= minParallelSize)
+        for (int32_t row = 0; row < size; row++)
+        {
+            double sum = 0.0;
+            for (int32_t k = A.rowOffsets[row]; k < A.rowOffsets[row + 1]; k++)
+                sum += A.values[k] * x[A.columns[k]];
+            y[row] = sum;
+            dot += x[row] * sum;
+        }
+
+        return dot;
+    }
+
+    /// <summary>
+    /// Calculates the constitutive matrix of the orthotropic material rotated by the fiber angle.
+    /// </summary>
+    ConstitutiveMatrix GetConstitutiveMatrix(const AriadneOrthotropicMaterial& material, double fiberAngle)
+    {
+        if (!std::isfinite(material.E1) || !std::isfinite(material.E2) || !std::isfinite(material.NU12) || !std::isfinite(material.G12))
+            throw std::invalid_argument("Material constants must be finite!");
+
+        if (material.E1 <= 0.0 || material.E2 <= 0.0 || material.G12 <= 0.0)
+            throw std::invalid_argument("Material moduli must be positive!");
+
+        // 1. Reduced stiffness in material axes
+        double nu21 = material.NU12 * material.E2 / material.E1;
+        double denominator = 1.0 - material.NU12 * nu21;
+        if (denominator <= 0.0)
+            throw std::invalid_argument("Material Poisson's ratio is invalid!");
+
+        double Q11 = material.E1 / denominator;
+        double Q22 = material.E2 / denominator;
+        double Q12 = material.NU12 * material.E2 / denominator;
+        double Q66 = material.G12;
+
+        // 2. Rotate to element axes
+        double angle = fiberAngle * pi / 180.0;
+        double c = std::cos(angle);
+        double s = std::sin(angle);
+        double c2 = c * c;
+        double s2 = s * s;
+
+        double Qb11 = Q11 * c2 * c2 + 2.0 * (Q12 + 2.0 * Q66) * s2 * c2 + Q22 * s2 * s2;
+        double Qb22 = Q11 * s2 * s2 + 2.0 * (Q12 + 2.0 * Q66) * s2 * c2 + Q22 * c2 * c2;
+        double Qb12 = (Q11 + Q22 - 4.0 * Q66) * s2 * c2 + Q12 * (s2 * s2 + c2 * c2);
+        double Qb16 = (Q11 - Q12 - 2.0 * Q66) * s * c2 * c + (Q12 - Q22 + 2.0 * Q66) * s2 * s * c;
+        double Qb26 = (Q11 - Q12 - 2.0 * Q66) * s2 * s * c + (Q12 - Q22 + 2.0 * Q66) * s * c2 * c;
+        double Qb66 = (Q11 + Q22 - 2.0 * Q12 - 2.0 * Q66) * s2 * c2 + Q66 * (s2 * s2 + c2 * c2);
+
+        return { Qb11, Qb12, Qb16,
+                 Qb12, Qb22, Qb26,
+                 Qb16, Qb26, Qb66 };
+    }
+
+    /// <summary>
+    /// Adds the contribution of one integration point to the element stiffness matrix: K += B^T * D * B * factor.
+    /// </summary>
+    void AddIntegrationPoint(const double* dNdx, const double* dNdy, int32_t nodesCount, const ConstitutiveMatrix& D, double factor, ElementMatrix& K)
+    {
+        int32_t elementDOFs = dofsPerNode * nodesCount;
+        for (int32_t a = 0; a < nodesCount; a++)
+        {
+            // D * B for node a: columns UX and UY
+            double DBx[3];
+            double DBy[3];
+            for (int32_t i = 0; i < 3; i++)
+            {
+                DBx[i] = D[i * 3 + 0] * dNdx[a] + D[i * 3 + 2] * dNdy[a];
+                DBy[i] = D[i * 3 + 1] * dNdy[a] + D[i * 3 + 2] * dNdx[a];
+            }
+
+            for (int32_t b = 0; b < nodesCount; b++)
+            {
+                // B^T for node b: rows UX and UY
+                K[(2 * b + 0) * elementDOFs + 2 * a + 0] += (dNdx[b] * DBx[0] + dNdy[b] * DBx[2]) * factor;
+                K[(2 * b + 0) * elementDOFs + 2 * a + 1] += (dNdx[b] * DBy[0] + dNdy[b] * DBy[2]) * factor;
+                K[(2 * b + 1) * elementDOFs + 2 * a + 0] += (dNdy[b] * DBx[1] + dNdx[b] * DBx[2]) * factor;
+                K[(2 * b + 1) * elementDOFs + 2 * a + 1] += (dNdy[b] * DBy[1] + dNdx[b] * DBy[2]) * factor;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Calculates the stiffness matrix of CTRIA3 (constant strain) or CQUAD4 (2x2 Gauss integration) element.
+    /// </summary>
+    /// <returns>true in the case, when the element is not degenerate</returns>
+    bool GetElementStiffness(const AriadnePlaneStressElement& element, const AriadneVector3D* nodes, const ConstitutiveMatrix& D, ElementMatrix& K)
+    {
+        K.fill(0.0);
+
+        double x[maxElementNodes];
+        double y[maxElementNodes];
+        for (int32_t i = 0; i < element.nodesCount; i++)
+        {
+            x[i] = nodes[element.nodes[i]].x;
+            y[i] = nodes[element.nodes[i]].y;
+        }
+
+        // Squared characteristic size of the element for the relative area tolerance
+        double size2 = 0.0;
+        for (int32_t i = 0; i < element.nodesCount; i++)
+        {
+            for (int32_t j = i + 1; j < element.nodesCount; j++)
+            {
+                double dx = x[j] - x[i];
+                double dy = y[j] - y[i];
+                size2 = std::max(size2, dx * dx + dy * dy);
+            }
+        }
+
+        if (element.nodesCount == 3)
+        {
+            double area2 = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+            if (std::abs(area2) <= degenerateTolerance * size2)
+                return false;
+
+            double dNdx[3] = { (y[1] - y[2]) / area2, (y[2] - y[0]) / area2, (y[0] - y[1]) / area2 };
+            double dNdy[3] = { (x[2] - x[1]) / area2, (x[0] - x[2]) / area2, (x[1] - x[0]) / area2 };
+            AddIntegrationPoint(dNdx, dNdy, 3, D, 0.5 * std::abs(area2) * element.thickness, K);
+            return true;
+        }
+
+        const double xi[4] = { -1.0, 1.0, 1.0, -1.0 };
+        const double eta[4] = { -1.0, -1.0, 1.0, 1.0 };
+        const double gauss = 1.0 / std::sqrt(3.0);
+
+        // detJ of the bilinear quadrilateral is linear in xi and eta, so the same sign at the corners
+        // guarantees the same sign over the whole element. Bow-tie and re-entrant quadrilaterals are rejected.
+        double cornerDetJ[4];
+        for (int32_t c = 0; c < 4; c++)
+        {
+            int32_t next = (c + 1) % 4;
+            int32_t previous = (c + 3) % 4;
+            cornerDetJ[c] = (x[next] - x[c]) * (y[previous] - y[c]) - (x[previous] - x[c]) * (y[next] - y[c]);
+        }
+
+        for (int32_t c = 0; c < 4; c++)
+        {
+            if (cornerDetJ[c] * cornerDetJ[0] <= 0.0 || std::abs(cornerDetJ[c]) <= degenerateTolerance * size2)
+                return false;
+        }
+
+        for (int32_t gp = 0; gp < 4; gp++)
+        {
+            double gxi = xi[gp] * gauss;
+            double geta = eta[gp] * gauss;
+
+            // 1. Derivatives of shape functions in natural coordinates
+            double dNdxi[4];
+            double dNdeta[4];
+            for (int32_t i = 0; i < 4; i++)
+            {
+                dNdxi[i] = 0.25 * xi[i] * (1.0 + eta[i] * geta);
+                dNdeta[i] = 0.25 * eta[i] * (1.0 + xi[i] * gxi);
+            }
+
+            // 2. Jacobian
+            double J11 = 0.0, J12 = 0.0, J21 = 0.0, J22 = 0.0;
+            for (int32_t i = 0; i < 4; i++)
+            {
+                J11 += dNdxi[i] * x[i];
+                J12 += dNdxi[i] * y[i];
+                J21 += dNdeta[i] * x[i];
+                J22 += dNdeta[i] * y[i];
+            }
+
+            double detJ = J11 * J22 - J12 * J21;
+
+            // 3. Derivatives of shape functions in element coordinates
+            double dNdx[4];
+            double dNdy[4];
+            for (int32_t i = 0; i < 4; i++)
+            {
+                dNdx[i] = (J22 * dNdxi[i] - J12 * dNdeta[i]) / detJ;
+                dNdy[i] = (-J21 * dNdxi[i] + J11 * dNdeta[i]) / detJ;
+            }
+
+            AddIntegrationPoint(dNdx, dNdy, 4, D, std::abs(detJ) * element.thickness, K);
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Builds the CSR pattern of the global stiffness matrix. Columns of every row are sorted.
+    /// </summary>
+    void BuildPattern(const AriadnePlaneStressElement* elements, int32_t elementsSize, int32_t nodesSize, SparseMatrix& A)
+    {
+        // 1. Collect node neighbours
+        std::vector<std::vector<int32_t>> neighbours(nodesSize);
+        for (int32_t e = 0; e < elementsSize; e++)
+        {
+            const auto& element = elements[e];
+            for (int32_t a = 0; a < element.nodesCount; a++)
+                for (int32_t b = 0; b < element.nodesCount; b++)
+                    neighbours[element.nodes[a]].push_back(element.nodes[b]);
+        }
+
+        for (auto& list : neighbours)
+        {
+            std::sort(list.begin(), list.end());
+            list.erase(std::unique(list.begin(), list.end()), list.end());
+        }
+
+        // 2. Build rows
+        int32_t dofsCount = dofsPerNode * nodesSize;
+        A.rowOffsets.assign(dofsCount + 1, 0);
+        for (int32_t n = 0; n < nodesSize; n++)
+            for (int32_t d = 0; d < dofsPerNode; d++)
+                A.rowOffsets[dofsPerNode * n + d + 1] = static_cast<int32_t>(neighbours[n].size()) * dofsPerNode;
+
+        for (int32_t row = 0; row < dofsCount; row++)
+            A.rowOffsets[row + 1] += A.rowOffsets[row];
+
+        A.columns.resize(A.rowOffsets[dofsCount]);
+        A.values.assign(A.rowOffsets[dofsCount], 0.0);
+
+        for (int32_t n = 0; n < nodesSize; n++)
+        {
+            for (int32_t d = 0; d < dofsPerNode; d++)
+            {
+                int32_t k = A.rowOffsets[dofsPerNode * n + d];
+                for (auto m : neighbours[n])
+                    for (int32_t dm = 0; dm < dofsPerNode; dm++)
+                        A.columns[k++] = dofsPerNode * m + dm;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Returns the root of the node in the disjoint set.
+    /// </summary>
+    int32_t FindRoot(std::vector<int32_t>& parents, int32_t node)
+    {
+        while (parents[node] != node)
+        {
+            parents[node] = parents[parents[node]];
+            node = parents[node];
+        }
+        return node;
+    }
+
+    /// <summary>
+    /// Checks that the constraints remove all three in-plane rigid body modes (UX, UY and rotation RZ)
+    /// of every connected part of the mesh, otherwise the model is a mechanism.
+    /// Every constrained DOF gives a row [1, 0, -y] (UX) or [0, 1, x] (UY) against the rigid body modes,
+    /// so the Gram matrix of these rows must have the full rank 3.
+    /// </summary>
+    void CheckRigidBodyModes(const AriadneVector3D* nodes, int32_t nodesSize, const AriadnePlaneStressElement* elements, int32_t elementsSize, const std::vector<char>& isConstrained)
+    {
+        // 1. Find connected parts of the mesh
+        std::vector<int32_t> parents(nodesSize);
+        std::vector<char> isUsed(nodesSize, 0);
+        for (int32_t n = 0; n < nodesSize; n++)
+            parents[n] = n;
+
+        for (int32_t e = 0; e < elementsSize; e++)
+        {
+            const auto& element = elements[e];
+            for (int32_t a = 0; a < element.nodesCount; a++)
+            {
+                isUsed[element.nodes[a]] = 1;
+                parents[FindRoot(parents, element.nodes[a])] = FindRoot(parents, element.nodes[0]);
+            }
+        }
+
+        // 2. Calculate centroid and size of every part for the scaling of coordinates
+        std::vector<double> xSum(nodesSize, 0.0), ySum(nodesSize, 0.0), size(nodesSize, 0.0);
+        std::vector<int32_t> count(nodesSize, 0);
+        for (int32_t n = 0; n < nodesSize; n++)
+        {
+            if (!isUsed[n])
+                continue;
+
+            int32_t root = FindRoot(parents, n);
+            xSum[root] += nodes[n].x;
+            ySum[root] += nodes[n].y;
+            count[root]++;
+        }
+
+        for (int32_t n = 0; n < nodesSize; n++)
+        {
+            if (!isUsed[n])
+                continue;
+
+            int32_t root = FindRoot(parents, n);
+            double dx = nodes[n].x - xSum[root] / count[root];
+            double dy = nodes[n].y - ySum[root] / count[root];
+            size[root] = std::max(size[root], std::sqrt(dx * dx + dy * dy));
+        }
+
+        // 3. Accumulate the Gram matrix of constraints against the rigid body modes
+        std::vector<std::array<double, 9>> grams(nodesSize);
+        for (int32_t n = 0; n < nodesSize; n++)
+        {
+            if (!isUsed[n])
+                continue;
+
+            int32_t root = FindRoot(parents, n);
+            double x = (nodes[n].x - xSum[root] / count[root]) / size[root];
+            double y = (nodes[n].y - ySum[root] / count[root]) / size[root];
+            auto& G = grams[root];
+
+            if (isConstrained[dofsPerNode * n + 0])
+            {
+                double row[3] = { 1.0, 0.0, -y };
+                for (int32_t i = 0; i < 3; i++)
+                    for (int32_t j = 0; j < 3; j++)
+                        G[i * 3 + j] += row[i] * row[j];
+            }
+
+            if (isConstrained[dofsPerNode * n + 1])
+            {
+                double row[3] = { 0.0, 1.0, x };
+                for (int32_t i = 0; i < 3; i++)
+                    for (int32_t j = 0; j < 3; j++)
+                        G[i * 3 + j] += row[i] * row[j];
+            }
+        }
+
+        // 4. Check the rank of every part
+        for (int32_t n = 0; n < nodesSize; n++)
+        {
+            if (!isUsed[n] || FindRoot(parents, n) != n)
+                continue;
+
+            const auto& G = grams[n];
+            double trace = G[0] + G[4] + G[8];
+            double det = G[0] * (G[4] * G[8] - G[5] * G[7])
+                       - G[1] * (G[3] * G[8] - G[5] * G[6])
+                       + G[2] * (G[3] * G[7] - G[4] * G[6]);
+
+            if (!(det > rigidBodyTolerance * trace * trace * trace))
+                throw std::invalid_argument("Model is a mechanism: constraints do not remove the rigid body modes UX, UY and RZ!");
+        }
+    }
+
+    /// <summary>
+    /// Plane stress solver state, which is kept between the design iterations.
+    /// The CSR pattern, the node incidences and the element matrices are built once,
+    /// so an update of the elements recalculates only the changed elements and their node rows.
+    /// </summary>
+    struct PlaneStressSolver
+    {
+        std::vector<AriadneVector3D> nodes;
+        std::vector<AriadnePlaneStressElement> elements;
+        std::vector<AriadneOrthotropicMaterial> materials;
+
+        // Element stiffness matrices
+        std::vector<ElementMatrix> elementMatrices;
+
+        // Elements and local node indices of every node
+        std::vector<std::vector<std::pair<int32_t, int32_t>>> nodeElements;
+
+        // Constrained DOFs and DOFs of free nodes (without elements)
+        std::vector<char> isConstrained;
+        std::vector<char> isFree;
+
+        // Global stiffness matrix with applied constraints
+        SparseMatrix A;
+
+        // Incomplete Cholesky factor IC(0) (lower triangle of A, the diagonal is the last entry of the row)
+        SparseMatrix factor;
+    };
+
+    /// <summary>
+    /// Validates the thickness and the fiber angle of the element.
+    /// </summary>
+    void ValidateElementParameters(double thickness, double fiberAngle)
+    {
+        if (!std::isfinite(thickness) || thickness <= 0.0)
+            throw std::invalid_argument("Element thickness must be positive!");
+
+        if (!std::isfinite(fiberAngle))
+            throw std::invalid_argument("Element fiber angle must be finite!");
+    }
+
+    /// <summary>
+    /// Calculates the stiffness matrices of the elements.
+    /// </summary>
+    void CalculateElementMatrices(PlaneStressSolver& solver, const std::vector<int32_t>& elementIndices)
+    {
+        int32_t size = static_cast<int32_t>(elementIndices.size());
+        int32_t degenerateCount = 0;
+
+#pragma omp parallel for reduction(+:degenerateCount)
+        for (int32_t i = 0; i < size; i++)
+        {
+            int32_t e = elementIndices[i];
+            const auto& element = solver.elements[e];
+            auto D = GetConstitutiveMatrix(solver.materials[element.materialIndex], element.fiberAngle);
+            if (!GetElementStiffness(element, solver.nodes.data(), D, solver.elementMatrices[e]))
+                degenerateCount++;
+        }
+
+        if (degenerateCount > 0)
+            throw std::invalid_argument("Element is degenerate!");
+    }
+
+    /// <summary>
+    /// Assembles the rows of the nodes from the element matrices and applies the constraints.
+    /// Every thread owns the rows of its nodes, so the element matrices are scattered without locks.
+    /// The constrained rows and columns are skipped, the diagonal of the constrained row is 1.
+    /// Free nodes have no elements, so their rows have the diagonal 1 too.
+    /// </summary>
+    void AssembleNodeRows(PlaneStressSolver& solver, const std::vector<int32_t>& nodeIndices)
+    {
+        auto& A = solver.A;
+        const auto& isConstrained = solver.isConstrained;
+        int32_t size = static_cast<int32_t>(nodeIndices.size());
+
+#pragma omp parallel for
+        for (int32_t i = 0; i < size; i++)
+        {
+            int32_t n = nodeIndices[i];
+
+            // 1. Clear rows of the node
+            for (int32_t d = 0; d < dofsPerNode; d++)
+            {
+                int32_t row = dofsPerNode * n + d;
+                for (int32_t k = A.rowOffsets[row]; k < A.rowOffsets[row + 1]; k++)
+                    A.values[k] = (isConstrained[row] && A.columns[k] == row) ? 1.0 : 0.0;
+            }
+
+            // 2. Scatter element matrices
+            for (const auto& incidence : solver.nodeElements[n])
+            {
+                int32_t e = incidence.first;
+                int32_t a = incidence.second;
+                const auto& element = solver.elements[e];
+                const auto& K = solver.elementMatrices[e];
+                int32_t elementDOFs = dofsPerNode * element.nodesCount;
+                for (int32_t d = 0; d < dofsPerNode; d++)
+                {
+                    int32_t row = dofsPerNode * n + d;
+                    if (isConstrained[row])
+                        continue;
+
+                    auto rowBegin = A.columns.begin() + A.rowOffsets[row];
+                    auto rowEnd = A.columns.begin() + A.rowOffsets[row + 1];
+                    for (int32_t b = 0; b < element.nodesCount; b++)
+                    {
+                        auto position = std::lower_bound(rowBegin, rowEnd, dofsPerNode * element.nodes[b]) - A.columns.begin();
+                        for (int32_t db = 0; db < dofsPerNode; db++)
+                        {
+                            if (!isConstrained[A.columns[position + db]])
+                                A.values[position + db] += K[(dofsPerNode * a + d) * elementDOFs + dofsPerNode * b + db];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Builds the pattern of the incomplete Cholesky factor: the lower triangle of the matrix pattern.
+    /// </summary>
+    void BuildFactorPattern(const SparseMatrix& A, SparseMatrix& L)
+    {
+        int32_t size = static_cast<int32_t>(A.rowOffsets.size()) - 1;
+        L.rowOffsets.assign(size + 1, 0);
+        L.columns.clear();
+        for (int32_t row = 0; row < size; row++)
+        {
+            for (int32_t k = A.rowOffsets[row]; k < A.rowOffsets[row + 1] && A.columns[k] <= row; k++)
+                L.columns.push_back(A.columns[k]);
+            L.rowOffsets[row + 1] = static_cast<int32_t>(L.columns.size());
+        }
+        L.values.resize(L.columns.size());
+    }
+
+    /// <summary>
+    /// Calculates the incomplete Cholesky factor IC(0) of the matrix, L * L^T = A + shift * diag(A).
+    /// Orthotropic materials with a rotated fiber make the matrix far from diagonally dominant,
+    /// so the factorization is repeated with an increasing diagonal shift until all pivots are positive.
+    /// </summary>
+    void Factorize(const SparseMatrix& A, SparseMatrix& L)
+    {
+        int32_t size = static_cast<int32_t>(A.rowOffsets.size()) - 1;
+        for (double shift = 0.0; shift <= maxFactorShift; shift = (shift == 0.0) ? minFactorShift : 2.0 * shift)
+        {
+            bool isPositive = true;
+            for (int32_t row = 0; row < size && isPositive; row++)
+            {
+                int32_t rowBegin = L.rowOffsets[row];
+                int32_t rowEnd = L.rowOffsets[row + 1];
+                for (int32_t k = rowBegin; k < rowEnd; k++)
+                {
+                    // L(i, j) = (A(i, j) - sum L(i, m) * L(j, m)) / L(j, j), m < j
+                    int32_t column = L.columns[k];
+                    double sum = A.values[A.rowOffsets[row] + (k - rowBegin)];
+                    int32_t a = rowBegin;
+                    int32_t b = L.rowOffsets[column];
+                    int32_t bEnd = L.rowOffsets[column + 1] - 1;
+                    while (a < k && b < bEnd)
+                    {
+                        if (L.columns[a] == L.columns[b])
+                            sum -= L.values[a++] * L.values[b++];
+                        else if (L.columns[a] < L.columns[b])
+                            a++;
+                        else
+                            b++;
+                    }
+
+                    if (column < row)
+                    {
+                        L.values[k] = sum / L.values[bEnd];
+                        continue;
+                    }
+
+                    sum += shift * A.values[A.rowOffsets[row] + (k - rowBegin)];
+                    if (!(sum > 0.0) || !std::isfinite(sum))
+                    {
+                        isPositive = false;
+                        break;
+                    }
+                    L.values[k] = std::sqrt(sum);
+                }
+            }
+
+            if (isPositive)
+                return;
+        }
+
+        throw std::runtime_error("Incomplete Cholesky factorization is failed!");
+    }
+
+    /// <summary>
+    /// Applies the incomplete Cholesky preconditioner z = (L * L^T)^-1 * r.
+    /// </summary>
+    /// <returns>Dot product r * z</returns>
+    double ApplyFactor(const SparseMatrix& L, const std::vector<double>& r, std::vector<double>& z)
+    {
+        int32_t size = static_cast<int32_t>(r.size());
+
+        // 1. Forward substitution L * z = r
+        for (int32_t row = 0; row < size; row++)
+        {
+            double sum = r[row];
+            int32_t diagonal = L.rowOffsets[row + 1] - 1;
+            for (int32_t k = L.rowOffsets[row]; k < diagonal; k++)
+                sum -= L.values[k] * z[L.columns[k]];
+            z[row] = sum / L.values[diagonal];
+        }
+
+        // 2. Backward substitution L^T * z = z by the columns of L^T (the rows of L)
+        double dot = 0.0;
+        for (int32_t row = size - 1; row >= 0; row--)
+        {
+            int32_t diagonal = L.rowOffsets[row + 1] - 1;
+            double value = z[row] / L.values[diagonal];
+            z[row] = value;
+            dot += r[row] * value;
+            for (int32_t k = L.rowOffsets[row]; k < diagonal; k++)
+                z[L.columns[k]] -= L.values[k] * value;
+        }
+
+        return dot;
+    }
+
+    /// <summary>
+    /// Creates the solver: validates the model, calculates the element matrices and assembles the global stiffness matrix.
+    /// </summary>
+    std::unique_ptr<PlaneStressSolver> CreateSolver(const AriadneVector3D* nodes, int32_t nodesSize,
+                                                    const AriadnePlaneStressElement* elements, int32_t elementsSize,
+                                                    const AriadneOrthotropicMaterial* materials, int32_t materialsSize,
+                                                    const int32_t* constrainedDOFs, int32_t constrainedDOFsSize)
+    {
+        int32_t dofsCount = dofsPerNode * nodesSize;
+
+        // 1. Validate nodes, materials and elements.
+        // Stiffness is calculated in the XY plane, so all nodes must lie in one plane parallel to XY.
+        double xMin = 0.0, xMax = 0.0, yMin = 0.0, yMax = 0.0;
+        for (int32_t n = 0; n < nodesSize; n++)
+        {
+            if (!std::isfinite(nodes[n].x) || !std::isfinite(nodes[n].y) || !std::isfinite(nodes[n].z))
+                throw std::invalid_argument("Node coordinates must be finite!");
+
+            xMin = (n == 0) ? nodes[n].x : std::min(xMin, static_cast<double>(nodes[n].x));
+            xMax = (n == 0) ? nodes[n].x : std::max(xMax, static_cast<double>(nodes[n].x));
+            yMin = (n == 0) ? nodes[n].y : std::min(yMin, static_cast<double>(nodes[n].y));
+            yMax = (n == 0) ? nodes[n].y : std::max(yMax, static_cast<double>(nodes[n].y));
+        }
+
+        double modelSize = std::max(xMax - xMin, yMax - yMin);
+        for (int32_t n = 1; n < nodesSize; n++)
+        {
+            if (std::abs(nodes[n].z - nodes[0].z) > planeTolerance * modelSize)
+                throw std::invalid_argument("Nodes must lie in a plane parallel to XY!");
+        }
+
+        for (int32_t m = 0; m < materialsSize; m++)
+            GetConstitutiveMatrix(materials[m], 0.0);
+
+        for (int32_t e = 0; e < elementsSize; e++)
+        {
+            const auto& element = elements[e];
+            if (element.nodesCount != 3 && element.nodesCount != 4)
+                throw std::invalid_argument("Only CTRIA3 and CQUAD4 elements are supported!");
+
+            if (element.materialIndex < 0 || element.materialIndex >= materialsSize)
+                throw std::out_of_range("Material index is out of range!");
+
+            ValidateElementParameters(element.thickness, element.fiberAngle);
+
+            for (int32_t i = 0; i < element.nodesCount; i++)
+            {
+                if (element.nodes[i] < 0 || element.nodes[i] >= nodesSize)
+                    throw std::out_of_range("Node index is out of range!");
+            }
+        }
+
+        auto solver = std::make_unique<PlaneStressSolver>();
+        solver->nodes.assign(nodes, nodes + nodesSize);
+        solver->elements.assign(elements, elements + elementsSize);
+        solver->materials.assign(materials, materials + materialsSize);
+
+        // 2. Apply constraints. DOFs of free nodes are constrained too.
+        solver->isConstrained.assign(dofsCount, 0);
+        for (int32_t i = 0; i < constrainedDOFsSize; i++)
+        {
+            if (constrainedDOFs[i] < 0 || constrainedDOFs[i] >= dofsCount)
+                throw std::out_of_range("Constrained DOF is out of range!");
+            solver->isConstrained[constrainedDOFs[i]] = 1;
+        }
+
+        CheckRigidBodyModes(nodes, nodesSize, elements, elementsSize, solver->isConstrained);
+
+        solver->nodeElements.resize(nodesSize);
+        for (int32_t e = 0; e < elementsSize; e++)
+            for (int32_t a = 0; a < elements[e].nodesCount; a++)
+                solver->nodeElements[elements[e].nodes[a]].emplace_back(e, a);
+
+        solver->isFree.assign(dofsCount, 0);
+        for (int32_t n = 0; n < nodesSize; n++)
+        {
+            if (!solver->nodeElements[n].empty())
+                continue;
+
+            for (int32_t d = 0; d < dofsPerNode; d++)
+            {
+                solver->isFree[dofsPerNode * n + d] = 1;
+                solver->isConstrained[dofsPerNode * n + d] = 1;
+            }
+        }
+
+        // 3. Calculate element stiffness matrices
+        std::vector<int32_t> allElements(elementsSize);
+        for (int32_t e = 0; e < elementsSize; e++)
+            allElements[e] = e;
+
+        solver->elementMatrices.resize(elementsSize);
+        CalculateElementMatrices(*solver, allElements);
+
+        // 4. Assemble global stiffness matrix
+        std::vector<int32_t> allNodes(nodesSize);
+        for (int32_t n = 0; n < nodesSize; n++)
+            allNodes[n] = n;
+
+        BuildPattern(elements, elementsSize, nodesSize, solver->A);
+        AssembleNodeRows(*solver, allNodes);
+
+        // 5. Calculate preconditioner
+        BuildFactorPattern(solver->A, solver->factor);
+        Factorize(solver->A, solver->factor);
+
+        return solver;
+    }
+
+    /// <summary>
+    /// Updates the thickness and the fiber angle of the elements. Only the changed elements and the rows of their nodes are recalculated.
+    /// </summary>
+    void UpdateSolver(PlaneStressSolver& solver, const int32_t* elementIndices, const double* thicknesses, const double* fiberAngles, int32_t size)
+    {
+        // 1. Validate elements
+        int32_t elementsSize = static_cast<int32_t>(solver.elements.size());
+        for (int32_t i = 0; i < size; i++)
+        {
+            if (elementIndices[i] < 0 || elementIndices[i] >= elementsSize)
+                throw std::out_of_range("Element index is out of range!");
+
+            ValidateElementParameters(thicknesses[i], fiberAngles[i]);
+        }
+
+        // 2. Recalculate element matrices
+        std::vector<int32_t> changedElements(elementIndices, elementIndices + size);
+        std::sort(changedElements.begin(), changedElements.end());
+        changedElements.erase(std::unique(changedElements.begin(), changedElements.end()), changedElements.end());
+
+        for (int32_t i = 0; i < size; i++)
+        {
+            solver.elements[elementIndices[i]].thickness = thicknesses[i];
+            solver.elements[elementIndices[i]].fiberAngle = fiberAngles[i];
+        }
+
+        CalculateElementMatrices(solver, changedElements);
+
+        // 3. Reassemble rows of the nodes of changed elements
+        std::vector<int32_t> changedNodes;
+        for (auto e : changedElements)
+            for (int32_t a = 0; a < solver.elements[e].nodesCount; a++)
+                changedNodes.push_back(solver.elements[e].nodes[a]);
+
+        std::sort(changedNodes.begin(), changedNodes.end());
+        changedNodes.erase(std::unique(changedNodes.begin(), changedNodes.end()), changedNodes.end());
+        AssembleNodeRows(solver, changedNodes);
+
+        // 4. Recalculate preconditioner. The fill of the incomplete factor depends on all previous rows, so it is calculated again.
+        Factorize(solver.A, solver.factor);
+    }
+
+    /// <summary>
+    /// Solves the system by the conjugate gradient method with the incomplete Cholesky preconditioner,
+    /// warm-started from the input displacements.
+    /// </summary>
+    std::string Solve(const PlaneStressSolver& solver, const double* loads, double* displacements, double tolerance, int32_t maxIterations)
+    {
+        const auto& A = solver.A;
+        const auto& L = solver.factor;
+        int32_t dofsCount = dofsPerNode * static_cast<int32_t>(solver.nodes.size());
+
+        // 1. Validate loads and displacements
+        for (int32_t i = 0; i < dofsCount; i++)
+        {
+            if (!std::isfinite(loads[i]) || !std::isfinite(displacements[i]))
+                throw std::invalid_argument("Loads and displacements must be finite!");
+
+            if (solver.isFree[i] && loads[i] != 0.0)
+                throw std::invalid_argument("Loaded DOF has no stiffness!");
+        }
+
+        std::vector<double> x(displacements, displacements + dofsCount);
+        std::vector<double> b(loads, loads + dofsCount);
+        for (int32_t i = 0; i < dofsCount; i++)
+        {
+            if (solver.isConstrained[i])
+            {
+                x[i] = 0.0;
+                b[i] = 0.0;
+            }
+        }
+
+        // 2. Initial residual
+        std::vector<double> r(dofsCount);
+        std::vector<double> z(dofsCount);
+        std::vector<double> p(dofsCount, 0.0);
+        std::vector<double> q(dofsCount);
+
+        double bb = 0.0;
+        double rr = 0.0;
+        Multiply(A, x, q);
+
+#pragma omp parallel for reduction(+:bb,rr) if(dofsCount >= minParallelSize)
+        for (int32_t i = 0; i < dofsCount; i++)
+        {
+            r[i] = b[i] - q[i];
+            bb += b[i] * b[i];
+            rr += r[i] * r[i];
+        }
+
+        double rz = ApplyFactor(L, r, z);
+
+        double bNorm = std::sqrt(bb);
+        double residual = 0.0;
+        int32_t iterations = 0;
+        bool isConverged = false;
+        bool isBreakdown = false;
+
+        if (bNorm <= 0.0)
+        {
+            std::fill(x.begin(), x.end(), 0.0);
+            isConverged = true;
+        }
+        else
+        {
+            residual = std::sqrt(rr) / bNorm;
+        }
+
+        // 3. Iterations. Every iteration has three parallel regions: the search direction, A * p with p * q
+        // and the update of the solution and the residual with r * r. The triangular solves of the preconditioner are sequential.
+        // Only a finite residual is stored, so the exported JSON never contains NaN or infinity.
+        double divergenceResidual = divergenceFactor * std::max(1.0, residual);
+        double beta = 0.0;
+        while (!isConverged && std::isfinite(residual))
+        {
+            if (residual <= tolerance)
+            {
+                isConverged = true;
+                break;
+            }
+
+            if (iterations >= maxIterations)
+                break;
+
+#pragma omp parallel for if(dofsCount >= minParallelSize)
+            for (int32_t i = 0; i < dofsCount; i++)
+                p[i] = z[i] + beta * p[i];
+
+            double pq = Multiply(A, p, q);
+
+            // Breakdown: the matrix is not positive definite or the values are not finite
+            if (!(pq > 0.0) || !(rz > 0.0) || !std::isfinite(pq))
+            {
+                isBreakdown = true;
+                break;
+            }
+
+            double alpha = rz / pq;
+            rr = 0.0;
+
+#pragma omp parallel for reduction(+:rr) if(dofsCount >= minParallelSize)
+            for (int32_t i = 0; i < dofsCount; i++)
+            {
+                x[i] += alpha * p[i];
+                r[i] -= alpha * q[i];
+                rr += r[i] * r[i];
+            }
+
+            double rzNew = ApplyFactor(L, r, z);
+            beta = rzNew / rz;
+            rz = rzNew;
+            iterations++;
+
+            double newResidual = std::sqrt(rr) / bNorm;
+            if (!std::isfinite(newResidual) || newResidual > divergenceResidual)
+            {
+                isBreakdown = true;
+                break;
+            }
+            residual = newResidual;
+        }
+
+        // The input displacements are the warm start of the next design iteration, so they are kept after breakdown or divergence.
+        // A finite iterate, which ran out of iterations, is closer to the solution and is returned for the next warm start.
+        if (!isBreakdown)
+            std::copy(x.begin(), x.end(), displacements);
+
+        // 4. Build result
+        std::ostringstream str;
+        str << "{\"Converged\":" << (isConverged ? "true" : "false")
+            << ",\"Iterations\":" << iterations
+            << ",\"Residual\":" << std::scientific << residual << "}\n";
+
+        return str.str();
+    }
+}
+
+int32_t __stdcall CreatePlaneStressSolver(AriadneVector3D* nodes, int nodesSize,
+                                          AriadnePlaneStressElement* elements, int elementsSize,
+                                          AriadneOrthotropicMaterial* materials, int materialsSize,
+                                          int32_t* constrainedDOFs, int constrainedDOFsSize,
+                                          void** solver)
+{
+    try
+    {
+        if (solver == nullptr)
+            throw std::invalid_argument("Solver is null!");
+
+        *solver = nullptr;
+        *solver = CreateSolver(nodes, nodesSize, elements, elementsSize, materials, materialsSize, constrainedDOFs, constrainedDOFsSize).release();
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        auto wt = ex.what();
+    }
+    return 1;
+}
+
+int32_t __stdcall UpdatePlaneStressSolver(void* solver, int32_t* elementIndices, double* thicknesses, double* fiberAngles, int size)
+{
+    try
+    {
+        if (solver == nullptr)
+            throw std::invalid_argument("Solver is null!");
+
+        UpdateSolver(*static_cast<PlaneStressSolver*>(solver), elementIndices, thicknesses, fiberAngles, size);
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        auto wt = ex.what();
+    }
+    return 1;
+}
+
+int32_t __stdcall SolvePlaneStressSystem(void* solver, double* loads, double* displacements, int dofsSize,
+                                         double tolerance, int32_t maxIterations, Notification notification)
+{
+    try
+    {
+        if (solver == nullptr)
+            throw std::invalid_argument("Solver is null!");
+
+        auto& planeStressSolver = *static_cast<PlaneStressSolver*>(solver);
+        if (dofsSize != dofsPerNode * static_cast<int32_t>(planeStressSolver.nodes.size()))
+            throw std::invalid_argument("Loads and displacements must contain two DOFs per node!");
+
+        auto str = Solve(planeStressSolver, loads, displacements, tolerance, maxIterations);
+        notification(str.c_str());
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        auto wt = ex.what();
+    }
+    return 1;
+}
+
+int32_t __stdcall ReleasePlaneStressSolver(void* solver)
+{
+    delete static_cast<PlaneStressSolver*>(solver);
+    return 0;
+}
+
+int32_t __stdcall SolvePlaneStress(AriadneVector3D* nodes, int nodesSize,
+                                   AriadnePlaneStressElement* elements, int elementsSize,
+                                   AriadneOrthotropicMaterial* materials, int materialsSize,
+                                   int32_t* constrainedDOFs, int constrainedDOFsSize,
+                                   double* loads, double* displacements,
+                                   double tolerance, int32_t maxIterations,
+                                   Notification notification)
+{
+    try
+    {
+        auto solver = CreateSolver(nodes, nodesSize, elements, elementsSize, materials, materialsSize, constrainedDOFs, constrainedDOFsSize);
+        auto str = Solve(*solver, loads, displacements, tolerance, maxIterations);
+        notification(str.c_str());
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        auto wt = ex.what();
+    }
+    return 1;
+}
@@ -0,0 +1,127 @@
+// Copyright 2022 Nikolay V. Zhivotenko
+// Licensed under the Apache License, Version 2.0
+// E-mail: niko.zvt@gmail.com
+
+// The following ifdef block is the standard way of creating macros which make exporting 
+// from a DLL simpler. All files within this DLL are compiled with the ARIADNE_CGAL_EXPORTS
+// symbol defined on the command line. This symbol should not be defined on any project
+// that uses this DLL. This way any other project whose source files include this file see 
+// ARIADNE_CGAL_API functions as being imported from a DLL, whereas this DLL sees symbols
+// defined with this macro as being exported.
+#pragma once
+#ifdef ARIADNE_CGAL_EXPORTS
+#define ARIADNE_CGAL_API __declspec(dllexport)
+#else
+#define ARIADNE_CGAL_API __declspec(dllimport)
+#endif
+
+#include "Ariadne.h"
+
+/// <summary>
+/// The method solves a linear static plane stress problem for a mesh of CTRIA3/CQUAD4 elements
+/// with orthotropic materials. All nodes must lie in one plane parallel to XY, each node has two DOFs (UX, UY).
+/// The element stiffness matrices are assembled in parallel into a CSR matrix, which is solved
+/// by the conjugate gradient method with the incomplete Cholesky IC(0) preconditioner. The constraints must remove the rigid body
+/// modes (UX, UY and RZ) of every connected part of the mesh, otherwise the model is rejected as a mechanism.
+/// For design iterations use CreatePlaneStressSolver, which keeps the assembled matrix between the solutions.
+/// </summary>
+/// <param name="nodes">Node coordinates</param>
+/// <param name="nodesSize">Count of nodes</param>
+/// <param name="elements">Elements (node indices, material index, positive thickness and fiber angle in degrees)</param>
+/// <param name="elementsSize">Count of elements</param>
+/// <param name="materials">Orthotropic materials</param>
+/// <param name="materialsSize">Count of materials</param>
+/// <param name="constrainedDOFs">Indices of DOFs with zero displacement (2 * node index + direction)</param>
+/// <param name="constrainedDOFsSize">Count of constrained DOFs</param>
+/// <param name="loads">Nodal forces, size is 2 * nodesSize</param>
+/// <param name="displacements">
+/// Nodal displacements, size is 2 * nodesSize. On input it is the initial guess
+/// (e.g. the field of the previous design iteration), on output - the solution.
+/// If the iterations are exhausted, the last iterate is returned. After breakdown or divergence
+/// the displacements are left unchanged.
+/// </param>
+/// <param name="tolerance">Relative residual tolerance</param>
+/// <param name="maxIterations">Maximum count of iterations</param>
+/// <param name="notification">Convergence info as JSON string</param>
+/// <returns>
+/// <para> - true in the case, when the result is valid.</para>
+/// JSON contain:<br/>
+///  - Converged  - true if the relative residual is less than tolerance.<br/>
+///  - Iterations - count of iterations.<br/>
+///  - Residual   - last finite relative residual.<br/>
+/// </returns>
+extern "C" int32_t ARIADNE_CGAL_API __stdcall SolvePlaneStress(AriadneVector3D* nodes, int nodesSize,
+                                                               AriadnePlaneStressElement* elements, int elementsSize,
+                                                               AriadneOrthotropicMaterial* materials, int materialsSize,
+                                                               int32_t* constrainedDOFs, int constrainedDOFsSize,
+                                                               double* loads, double* displacements,
+                                                               double tolerance, int32_t maxIterations,
+                                                               Notification notification);
+
+/// <summary>
+/// The method creates a plane stress solver for design iterations. The model is validated as in SolvePlaneStress,
+/// the element stiffness matrices and the CSR matrix are built once and kept until ReleasePlaneStressSolver.
+/// </summary>
+/// <param name="nodes">Node coordinates</param>
+/// <param name="nodesSize">Count of nodes</param>
+/// <param name="elements">Elements (node indices, material index, positive thickness and fiber angle in degrees)</param>
+/// <param name="elementsSize">Count of elements</param>
+/// <param name="materials">Orthotropic materials</param>
+/// <param name="materialsSize">Count of materials</param>
+/// <param name="constrainedDOFs">Indices of DOFs with zero displacement (2 * node index + direction)</param>
+/// <param name="constrainedDOFsSize">Count of constrained DOFs</param>
+/// <param name="solver">Solver handle</param>
+/// <returns>
+/// <para> - true in the case, when the result is valid.</para>
+/// </returns>
+extern "C" int32_t ARIADNE_CGAL_API __stdcall CreatePlaneStressSolver(AriadneVector3D* nodes, int nodesSize,
+                                                                      AriadnePlaneStressElement* elements, int elementsSize,
+                                                                      AriadneOrthotropicMaterial* materials, int materialsSize,
+                                                                      int32_t* constrainedDOFs, int constrainedDOFsSize,
+                                                                      void** solver);
+
+/// <summary>
+/// The method updates the thickness and the fiber angle of the elements. Only the stiffness matrices
+/// of these elements and the matrix rows of their nodes are recalculated, then the preconditioner is refactorized.
+/// </summary>
+/// <param name="solver">Solver handle</param>
+/// <param name="elementIndices">Indices of changed elements</param>
+/// <param name="thicknesses">New positive thicknesses</param>
+/// <param name="fiberAngles">New fiber angles in degrees</param>
+/// <param name="size">Count of changed elements</param>
+/// <returns>
+/// <para> - true in the case, when the result is valid.</para>
+/// </returns>
+extern "C" int32_t ARIADNE_CGAL_API __stdcall UpdatePlaneStressSolver(void* solver, int32_t* elementIndices,
+                                                                      double* thicknesses, double* fiberAngles, int size);
+
+/// <summary>
+/// The method solves the plane stress problem of the solver for the loads.
+/// </summary>
+/// <param name="solver">Solver handle</param>
+/// <param name="loads">Nodal forces, size is 2 * nodesSize</param>
+/// <param name="displacements">
+/// Nodal displacements, size is 2 * nodesSize. On input it is the initial guess
+/// (e.g. the field of the previous design iteration), on output - the solution.
+/// If the iterations are exhausted, the last iterate is returned. After breakdown or divergence
+/// the displacements are left unchanged.
+/// </param>
+/// <param name="dofsSize">Count of loads and displacements (2 * nodesSize)</param>
+/// <param name="tolerance">Relative residual tolerance</param>
+/// <param name="maxIterations">Maximum count of iterations</param>
+/// <param name="notification">Convergence info as JSON string (see SolvePlaneStress)</param>
+/// <returns>
+/// <para> - true in the case, when the result is valid.</para>
+/// </returns>
+extern "C" int32_t ARIADNE_CGAL_API __stdcall SolvePlaneStressSystem(void* solver, double* loads, double* displacements, int dofsSize,
+                                                                     double tolerance, int32_t maxIterations,
+                                                                     Notification notification);
+
+/// <summary>
+/// The method releases the plane stress solver.
+/// </summary>
+/// <param name="solver">Solver handle</param>
+/// <returns>
+/// <para> - true in the case, when the result is valid.</para>
+/// </returns>
+extern "C" int32_t ARIADNE_CGAL_API __stdcall ReleasePlaneStressSolver(void* solver);
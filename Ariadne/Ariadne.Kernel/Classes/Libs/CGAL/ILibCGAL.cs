@@ -5,6 +5,7 @@
 using Ariadne.Kernel.CGAL;
 using Ariadne.Kernel;
 using Ariadne.Kernel.Math;
+using System;
 using System.Collections.Generic;
 using System.Runtime.InteropServices;
 
@@ -100,5 +101,71 @@ namespace Ariadne.Kernel.Libs
         /// - true in the case, when the result is valid.
         /// </returns>
         public bool CGAL_TransformPoint(Vector3D point, CoordinateSystem sourceCS, CoordinateSystem targetCS, out Vector3D transformPoint);
+
+        /// <summary>
+        /// The method solves a linear static plane stress problem for CTRIA3/CQUAD4 elements with orthotropic materials.
+        /// All nodes must lie in one plane parallel to XY, each node has two DOFs (UX, UY).
+        /// </summary>
+        /// <param name="nodes">Node coordinates.</param>
+        /// <param name="elements">Elements.</param>
+        /// <param name="materials">Orthotropic materials.</param>
+        /// <param name="constrainedDOFs">Indices of DOFs with zero displacement (2 * node index + direction).</param>
+        /// <param name="loads">Nodal forces, size is 2 * count of nodes.</param>
+        /// <param name="displacements">Nodal displacements. On input it is the initial guess (e.g. the field of the previous design iteration), on output - the solution. If the iterations are exhausted, it is the last iterate. After breakdown or divergence, the displacements are left unchanged.</param>
+        /// <param name="tolerance">Relative residual tolerance.</param>
+        /// <param name="maxIterations">Maximum count of iterations.</param>
+        /// <param name="iterations">Count of iterations.</param>
+        /// <param name="residual">Relative residual.</param>
+        /// <returns>
+        /// - true in the case, when the solution is converged.
+        /// </returns>
+        public bool CGAL_SolvePlaneStress(List<Vector3D> nodes, CGAL_PlaneStressElement[] elements, CGAL_OrthotropicMaterial[] materials, int[] constrainedDOFs, double[] loads, double[] displacements, double tolerance, int maxIterations, out int iterations, out double residual);
+
+        /// <summary>
+        /// The method creates a plane stress solver for design iterations. The stiffness matrix is assembled once
+        /// and kept until the solver is released by CGAL_ReleasePlaneStressSolver.
+        /// </summary>
+        /// <param name="nodes">Node coordinates.</param>
+        /// <param name="elements">Elements.</param>
+        /// <param name="materials">Orthotropic materials.</param>
+        /// <param name="constrainedDOFs">Indices of DOFs with zero displacement (2 * node index + direction).</param>
+        /// <param name="solver">Solver handle.</param>
+        /// <returns>
+        /// - true in the case, when the result is valid.
+        /// </returns>
+        public bool CGAL_CreatePlaneStressSolver(List<Vector3D> nodes, CGAL_PlaneStressElement[] elements, CGAL_OrthotropicMaterial[] materials, int[] constrainedDOFs, out IntPtr solver);
+
+        /// <summary>
+        /// The method updates the thickness and the fiber angle of the elements. Only the changed elements are recalculated.
+        /// </summary>
+        /// <param name="solver">Solver handle.</param>
+        /// <param name="elementIndices">Indices of changed elements.</param>
+        /// <param name="thicknesses">New thicknesses.</param>
+        /// <param name="fiberAngles">New fiber angles in degrees.</param>
+        /// <returns>
+        /// - true in the case, when the result is valid.
+        /// </returns>
+        public bool CGAL_UpdatePlaneStressSolver(IntPtr solver, int[] elementIndices, double[] thicknesses, double[] fiberAngles);
+
+        /// <summary>
+        /// The method solves the plane stress problem of the solver.
+        /// </summary>
+        /// <param name="solver">Solver handle.</param>
+        /// <param name="loads">Nodal forces, size is 2 * count of nodes.</param>
+        /// <param name="displacements">Nodal displacements. On input it is the initial guess (e.g. the field of the previous design iteration), on output - the solution. If the iterations are exhausted, it is the last iterate. After breakdown or divergence, the displacements are left unchanged.</param>
+        /// <param name="tolerance">Relative residual tolerance.</param>
+        /// <param name="maxIterations">Maximum count of iterations.</param>
+        /// <param name="iterations">Count of iterations.</param>
+        /// <param name="residual">Relative residual.</param>
+        /// <returns>
+        /// - true in the case, when the solution is converged.
+        /// </returns>
+        public bool CGAL_SolvePlaneStressSystem(IntPtr solver, double[] loads, double[] displacements, double tolerance, int maxIterations, out int iterations, out double residual);
+
+        /// <summary>
+        /// The method releases the plane stress solver.
+        /// </summary>
+        /// <param name="solver">Solver handle.</param>
+        public void CGAL_ReleasePlaneStressSolver(IntPtr solver);
     }
 }
\ No newline at end of file
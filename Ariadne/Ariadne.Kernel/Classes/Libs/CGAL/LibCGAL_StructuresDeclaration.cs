@@ -33,4 +33,41 @@ namespace Ariadne.Kernel.CGAL
             O = o; X = x; Y = y; Z = z;
         }
     }
+
+    /// <summary>
+    /// CGAL orthotropic material (MAT8)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct CGAL_OrthotropicMaterial
+    {
+        public double E1, E2, NU12, G12;
+
+        public CGAL_OrthotropicMaterial(double e1, double e2, double nu12, double g12)
+        {
+            E1 = e1; E2 = e2; NU12 = nu12; G12 = g12;
+        }
+    }
+
+    /// <summary>
+    /// CGAL plane stress element (CTRIA3, CQUAD4).
+    /// Node and material fields are indices into the arrays passed to the solver, N4 is ignored for CTRIA3.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct CGAL_PlaneStressElement
+    {
+        public int N1, N2, N3, N4;
+        public int NodesCount;
+        public int MaterialIndex;
+        public double Thickness;
+        public double FiberAngle;
+
+        public CGAL_PlaneStressElement(int[] nodes, int materialIndex, double thickness, double fiberAngle)
+        {
+            N1 = nodes[0]; N2 = nodes[1]; N3 = nodes[2]; N4 = nodes.Length > 3 ? nodes[3] : -1;
+            NodesCount = nodes.Length;
+            MaterialIndex = materialIndex;
+            Thickness = thickness;
+            FiberAngle = fiberAngle;
+        }
+    }
 }
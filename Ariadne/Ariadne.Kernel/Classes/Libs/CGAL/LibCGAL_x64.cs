@@ -101,6 +101,99 @@ namespace Ariadne.Kernel.CGAL
         [DllImport("Ariadne.CGAL.x64", CallingConvention = CallingConvention.StdCall, ExactSpelling = false, EntryPoint = "TransformPoint")]
         private static extern int TransformPoint([In] CGAL_Vector3D point, [In] CGAL_LCS sourceCS, [In] CGAL_LCS targetCS, Notification notification);
 
+        /// <summary>
+        /// The method solves a linear static plane stress problem for CTRIA3/CQUAD4 elements with orthotropic materials.
+        /// </summary>
+        /// <param name="nodes">Node coordinates</param>
+        /// <param name="nodesSize">Count of nodes</param>
+        /// <param name="elements">Elements</param>
+        /// <param name="elementsSize">Count of elements</param>
+        /// <param name="materials">Orthotropic materials</param>
+        /// <param name="materialsSize">Count of materials</param>
+        /// <param name="constrainedDOFs">Indices of DOFs with zero displacement</param>
+        /// <param name="constrainedDOFsSize">Count of constrained DOFs</param>
+        /// <param name="loads">Nodal forces</param>
+        /// <param name="displacements">Nodal displacements: initial guess on input, solution or last iterate on output (unchanged after breakdown or divergence)</param>
+        /// <param name="tolerance">Relative residual tolerance</param>
+        /// <param name="maxIterations">Maximum count of iterations</param>
+        /// <param name="notification">Convergence info as JSON string</param>
+        /// <returns>
+        /// - true in the case, when the result is valid
+        /// </returns>
+        [DllImport("Ariadne.CGAL.x64", CallingConvention = CallingConvention.StdCall, ExactSpelling = false, EntryPoint = "SolvePlaneStress")]
+        private static extern int SolvePlaneStress([In] CGAL_Vector3D[] nodes, [In] int nodesSize,
+                                                   [In] CGAL_PlaneStressElement[] elements, [In] int elementsSize,
+                                                   [In] CGAL_OrthotropicMaterial[] materials, [In] int materialsSize,
+                                                   [In] int[] constrainedDOFs, [In] int constrainedDOFsSize,
+                                                   [In] double[] loads, [In, Out] double[] displacements,
+                                                   [In] double tolerance, [In] int maxIterations,
+                                                   Notification notification);
+
+        /// <summary>
+        /// The method creates a plane stress solver for design iterations
+        /// </summary>
+        /// <param name="nodes">Node coordinates</param>
+        /// <param name="nodesSize">Count of nodes</param>
+        /// <param name="elements">Elements</param>
+        /// <param name="elementsSize">Count of elements</param>
+        /// <param name="materials">Orthotropic materials</param>
+        /// <param name="materialsSize">Count of materials</param>
+        /// <param name="constrainedDOFs">Indices of DOFs with zero displacement</param>
+        /// <param name="constrainedDOFsSize">Count of constrained DOFs</param>
+        /// <param name="solver">Solver handle</param>
+        /// <returns>
+        /// - true in the case, when the result is valid
+        /// </returns>
+        [DllImport("Ariadne.CGAL.x64", CallingConvention = CallingConvention.StdCall, ExactSpelling = false, EntryPoint = "CreatePlaneStressSolver")]
+        private static extern int CreatePlaneStressSolver([In] CGAL_Vector3D[] nodes, [In] int nodesSize,
+                                                          [In] CGAL_PlaneStressElement[] elements, [In] int elementsSize,
+                                                          [In] CGAL_OrthotropicMaterial[] materials, [In] int materialsSize,
+                                                          [In] int[] constrainedDOFs, [In] int constrainedDOFsSize,
+                                                          out IntPtr solver);
+
+        /// <summary>
+        /// The method updates the thickness and the fiber angle of the elements
+        /// </summary>
+        /// <param name="solver">Solver handle</param>
+        /// <param name="elementIndices">Indices of changed elements</param>
+        /// <param name="thicknesses">New thicknesses</param>
+        /// <param name="fiberAngles">New fiber angles in degrees</param>
+        /// <param name="size">Count of changed elements</param>
+        /// <returns>
+        /// - true in the case, when the result is valid
+        /// </returns>
+        [DllImport("Ariadne.CGAL.x64", CallingConvention = CallingConvention.StdCall, ExactSpelling = false, EntryPoint = "UpdatePlaneStressSolver")]
+        private static extern int UpdatePlaneStressSolver([In] IntPtr solver, [In] int[] elementIndices,
+                                                          [In] double[] thicknesses, [In] double[] fiberAngles, [In] int size);
+
+        /// <summary>
+        /// The method solves the plane stress problem of the solver
+        /// </summary>
+        /// <param name="solver">Solver handle</param>
+        /// <param name="loads">Nodal forces</param>
+        /// <param name="displacements">Nodal displacements: initial guess on input, solution or last iterate on output (unchanged after breakdown or divergence)</param>
+        /// <param name="dofsSize">Count of loads and displacements</param>
+        /// <param name="tolerance">Relative residual tolerance</param>
+        /// <param name="maxIterations">Maximum count of iterations</param>
+        /// <param name="notification">Convergence info as JSON string</param>
+        /// <returns>
+        /// - true in the case, when the result is valid
+        /// </returns>
+        [DllImport("Ariadne.CGAL.x64", CallingConvention = CallingConvention.StdCall, ExactSpelling = false, EntryPoint = "SolvePlaneStressSystem")]
+        private static extern int SolvePlaneStressSystem([In] IntPtr solver, [In] double[] loads, [In, Out] double[] displacements, [In] int dofsSize,
+                                                         [In] double tolerance, [In] int maxIterations,
+                                                         Notification notification);
+
+        /// <summary>
+        /// The method releases the plane stress solver
+        /// </summary>
+        /// <param name="solver">Solver handle</param>
+        /// <returns>
+        /// - true in the case, when the result is valid
+        /// </returns>
+        [DllImport("Ariadne.CGAL.x64", CallingConvention = CallingConvention.StdCall, ExactSpelling = false, EntryPoint = "ReleasePlaneStressSolver")]
+        private static extern int ReleasePlaneStressSolver([In] IntPtr solver);
+
         #endregion
 
         #region "CGAL_INTERFACE_IMPLEMENTATION"
@@ -447,7 +540,158 @@ namespace Ariadne.Kernel.CGAL
             return true;
         }
 
+        /// <summary>
+        /// The method solves a linear static plane stress problem for CTRIA3/CQUAD4 elements with orthotropic materials.
+        /// All nodes must lie in one plane parallel to XY, each node has two DOFs (UX, UY).
+        /// </summary>
+        /// <param name="nodes">Node coordinates.</param>
+        /// <param name="elements">Elements.</param>
+        /// <param name="materials">Orthotropic materials.</param>
+        /// <param name="constrainedDOFs">Indices of DOFs with zero displacement (2 * node index + direction).</param>
+        /// <param name="loads">Nodal forces, size is 2 * count of nodes.</param>
+        /// <param name="displacements">Nodal displacements. On input it is the initial guess (e.g. the field of the previous design iteration), on output - the solution. If the iterations are exhausted, it is the last iterate. After breakdown or divergence, the displacements are left unchanged.</param>
+        /// <param name="tolerance">Relative residual tolerance.</param>
+        /// <param name="maxIterations">Maximum count of iterations.</param>
+        /// <param name="iterations">Count of iterations.</param>
+        /// <param name="residual">Relative residual.</param>
+        /// <returns>
+        /// - true in the case, when the solution is converged.
+        /// </returns>
+        public bool CGAL_SolvePlaneStress(List<Vector3D> nodes, CGAL_PlaneStressElement[] elements, CGAL_OrthotropicMaterial[] materials, int[] constrainedDOFs, double[] loads, double[] displacements, double tolerance, int maxIterations, out int iterations, out double residual)
+        {
+            int countOfDOFs = 2 * nodes.Count;
+            if (loads.Length != countOfDOFs || displacements.Length != countOfDOFs)
+                throw new System.ArgumentOutOfRangeException("Loads and displacements must contain two DOFs per node!");
+
+            // 1. Run CGAL
+            CGAL_Vector3D[] cgalNodes = new CGAL_Vector3D[nodes.Count];
+            int index = 0;
+            foreach (var node in nodes)
+            {
+                cgalNodes[index] = new CGAL_Vector3D(node.X, node.Y, node.Z);
+                index++;
+            }
+
+            var jsonString = string.Empty;
+            int result = SolvePlaneStress(cgalNodes, cgalNodes.Length,
+                                          elements, elements.Length,
+                                          materials, materials.Length,
+                                          constrainedDOFs, constrainedDOFs.Length,
+                                          loads, displacements,
+                                          tolerance, maxIterations,
+                                          str => { jsonString = str; });
+
+            if (result == 1 || string.IsNullOrEmpty(jsonString))
+                throw new System.Exception("CGAL lib is fail!");
+
+            // 2. Deserialize convergence info from C++ lib
+            using var json = JsonDocument.Parse(jsonString);
+            iterations = json.RootElement.GetProperty("Iterations").GetInt32();
+            residual = json.RootElement.GetProperty("Residual").GetDouble();
+
+            return json.RootElement.GetProperty("Converged").GetBoolean();
+        }
+
+        /// <summary>
+        /// The method creates a plane stress solver for design iterations. The stiffness matrix is assembled once
+        /// and kept until the solver is released by CGAL_ReleasePlaneStressSolver.
+        /// </summary>
+        /// <param name="nodes">Node coordinates.</param>
+        /// <param name="elements">Elements.</param>
+        /// <param name="materials">Orthotropic materials.</param>
+        /// <param name="constrainedDOFs">Indices of DOFs with zero displacement (2 * node index + direction).</param>
+        /// <param name="solver">Solver handle.</param>
+        /// <returns>
+        /// - true in the case, when the result is valid.
+        /// </returns>
+        public bool CGAL_CreatePlaneStressSolver(List<Vector3D> nodes, CGAL_PlaneStressElement[] elements, CGAL_OrthotropicMaterial[] materials, int[] constrainedDOFs, out IntPtr solver)
+        {
+            // 1. Run CGAL
+            CGAL_Vector3D[] cgalNodes = new CGAL_Vector3D[nodes.Count];
+            int index = 0;
+            foreach (var node in nodes)
+            {
+                cgalNodes[index] = new CGAL_Vector3D(node.X, node.Y, node.Z);
+                index++;
+            }
+
+            int result = CreatePlaneStressSolver(cgalNodes, cgalNodes.Length,
+                                                 elements, elements.Length,
+                                                 materials, materials.Length,
+                                                 constrainedDOFs, constrainedDOFs.Length,
+                                                 out solver);
+
+            if (result == 1 || solver == IntPtr.Zero)
+                throw new System.Exception("CGAL lib is fail!");
+
+            return true;
+        }
+
+        /// <summary>
+        /// The method updates the thickness and the fiber angle of the elements. Only the changed elements are recalculated.
+        /// </summary>
+        /// <param name="solver">Solver handle.</param>
+        /// <param name="elementIndices">Indices of changed elements.</param>
+        /// <param name="thicknesses">New thicknesses.</param>
+        /// <param name="fiberAngles">New fiber angles in degrees.</param>
+        /// <returns>
+        /// - true in the case, when the result is valid.
+        /// </returns>
+        public bool CGAL_UpdatePlaneStressSolver(IntPtr solver, int[] elementIndices, double[] thicknesses, double[] fiberAngles)
+        {
+            if (thicknesses.Length != elementIndices.Length || fiberAngles.Length != elementIndices.Length)
+                throw new System.ArgumentOutOfRangeException("Thicknesses and fiber angles must be set for every changed element!");
 
+            int result = UpdatePlaneStressSolver(solver, elementIndices, thicknesses, fiberAngles, elementIndices.Length);
+            if (result == 1)
+                throw new System.Exception("CGAL lib is fail!");
+
+            return true;
+        }
+
+        /// <summary>
+        /// The method solves the plane stress problem of the solver.
+        /// </summary>
+        /// <param name="solver">Solver handle.</param>
+        /// <param name="loads">Nodal forces, size is 2 * count of nodes.</param>
+        /// <param name="displacements">Nodal displacements. On input it is the initial guess (e.g. the field of the previous design iteration), on output - the solution. If the iterations are exhausted, it is the last iterate. After breakdown or divergence, the displacements are left unchanged.</param>
+        /// <param name="tolerance">Relative residual tolerance.</param>
+        /// <param name="maxIterations">Maximum count of iterations.</param>
+        /// <param name="iterations">Count of iterations.</param>
+        /// <param name="residual">Relative residual.</param>
+        /// <returns>
+        /// - true in the case, when the solution is converged.
+        /// </returns>
+        public bool CGAL_SolvePlaneStressSystem(IntPtr solver, double[] loads, double[] displacements, double tolerance, int maxIterations, out int iterations, out double residual)
+        {
+            if (loads.Length != displacements.Length)
+                throw new System.ArgumentOutOfRangeException("Loads and displacements must contain two DOFs per node!");
+
+            // 1. Run CGAL
+            var jsonString = string.Empty;
+            int result = SolvePlaneStressSystem(solver, loads, displacements, loads.Length,
+                                                tolerance, maxIterations,
+                                                str => { jsonString = str; });
+
+            if (result == 1 || string.IsNullOrEmpty(jsonString))
+                throw new System.Exception("CGAL lib is fail!");
+
+            // 2. Deserialize convergence info from C++ lib
+            using var json = JsonDocument.Parse(jsonString);
+            iterations = json.RootElement.GetProperty("Iterations").GetInt32();
+            residual = json.RootElement.GetProperty("Residual").GetDouble();
+
+            return json.RootElement.GetProperty("Converged").GetBoolean();
+        }
+
+        /// <summary>
+        /// The method releases the plane stress solver.
+        /// </summary>
+        /// <param name="solver">Solver handle.</param>
+        public void CGAL_ReleasePlaneStressSolver(IntPtr solver)
+        {
+            ReleasePlaneStressSolver(solver);
+        }
 
         #endregion
     }